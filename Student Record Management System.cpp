@@ -5,8 +5,18 @@
 #include <iomanip>
 #include <limits>
 #include <fstream>
-#include <sstream>
 #include <cctype>
+#include <unordered_set>
+#include <cstdint>
+#include <charconv>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <filesystem>
 
 using namespace std;
 
@@ -19,39 +29,454 @@ private:
     string email;
     string course;
 
+    // The schema reads and writes fields through member pointers
+    friend struct StudentSchema;
+
 public:
+    Student() : id(0), age(0) {}
+
     Student(int studentId, const string& studentName, int studentAge,
             const string& studentEmail, const string& studentCourse)
         : id(studentId), name(studentName), age(studentAge),
           email(studentEmail), course(studentCourse) {}
 
     int getId() const { return id; }
-    string getName() const { return name; }
+    const string& getName() const { return name; }
     int getAge() const { return age; }
-    string getEmail() const { return email; }
-    string getCourse() const { return course; }
+    const string& getEmail() const { return email; }
+    const string& getCourse() const { return course; }
 
+    void setId(int newId) { id = newId; }
     void setName(const string& newName) { name = newName; }
     void setAge(int newAge) { age = newAge; }
     void setEmail(const string& newEmail) { email = newEmail; }
     void setCourse(const string& newCourse) { course = newCourse; }
 
-    void display() const {
-        cout << left << setw(5) << id
-             << setw(20) << name
-             << setw(5) << age
-             << setw(25) << email
-             << setw(15) << course << endl;
+    // Generated from StudentSchema, defined below it
+    void display() const;
+    void displayCompact() const;
+};
+
+// ====================== Field Codecs ======================
+// Per-type formatting, parsing and ordering used by every schema field.
+template <typename T>
+struct FieldCodec;
+
+template <>
+struct FieldCodec<int> {
+    static void format(string& out, int value) {
+        char buf[16];
+        auto result = to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, result.ptr);
     }
-    
-    void displayCompact() const {
-        cout << "ID: " << id << " | Name: " << name 
-             << " | Age: " << age << " | Course: " << course << endl;
+
+    // Accepts what stoi() did: leading whitespace, an optional sign, and
+    // anything after the digits ("+21", " 7", "12abc" all parse)
+    static bool parse(string_view text, int& value) {
+        while (!text.empty() && isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+        if (text.size() > 1 && text.front() == '+' && text[1] != '-') text.remove_prefix(1);
+        auto result = from_chars(text.data(), text.data() + text.size(), value);
+        return result.ec == errc();
     }
-    
-    // For file saving
-    string toFileString() const {
-        return to_string(id) + "," + name + "," + to_string(age) + "," + email + "," + course;
+
+    static bool less(int a, int b) { return a < b; }
+};
+
+template <>
+struct FieldCodec<string> {
+    static void format(string& out, const string& value) { out += value; }
+
+    static bool parse(string_view text, string& value) {
+        value.assign(text.data(), text.size());
+        return true;
+    }
+
+    // Case-insensitive, same order as comparing toLower() copies
+    static bool less(const string& a, const string& b) {
+        return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(),
+            [](unsigned char x, unsigned char y) { return tolower(x) < tolower(y); });
+    }
+};
+
+// ====================== Student Schema ======================
+// The file format, table output, compact output and sort comparators are all
+// generated from the Fields list below. Adding a field still takes: the member
+// and its constructor argument/accessors in Student, a *_LABEL constant, a
+// Field line, an enum entry at the same position, and the add/update prompts.
+// The static_asserts after StudentSchema catch an enum that is out of step.
+template <typename T, T Student::*Member, const char* Label, int Width, bool Compact>
+struct Field {
+    using Type = T;
+    static constexpr const char* label = Label;
+    static constexpr int width = Width;        // column width in the table view
+    static constexpr bool compact = Compact;   // shown by displayCompact()
+
+    static const T& get(const Student& s) { return s.*Member; }
+    static T& ref(Student& s) { return s.*Member; }
+};
+
+constexpr char ID_LABEL[] = "ID";
+constexpr char NAME_LABEL[] = "Name";
+constexpr char AGE_LABEL[] = "Age";
+constexpr char EMAIL_LABEL[] = "Email";
+constexpr char COURSE_LABEL[] = "Course";
+
+struct StudentSchema {
+    using Fields = tuple<
+        Field<int,    &Student::id,     ID_LABEL,     5,  true>,
+        Field<string, &Student::name,   NAME_LABEL,   20, true>,
+        Field<int,    &Student::age,    AGE_LABEL,    5,  true>,
+        Field<string, &Student::email,  EMAIL_LABEL,  25, false>,
+        Field<string, &Student::course, COURSE_LABEL, 15, true>>;
+
+    // Field indices, for picking a comparator; must follow the Fields order
+    enum { ID, NAME, AGE, EMAIL, COURSE, FIELD_COUNT };
+
+    static constexpr size_t COUNT = tuple_size<Fields>::value;
+
+    template <size_t I>
+    using At = tuple_element_t<I, Fields>;
+
+    // Calls f(integral_constant<size_t, I>) for every field, unrolled at compile time
+    template <typename F, size_t... I>
+    static void forEachField(F&& f, index_sequence<I...>) {
+        (f(integral_constant<size_t, I>()), ...);
+    }
+
+    template <typename F>
+    static void forEachField(F&& f) {
+        forEachField(f, make_index_sequence<COUNT>());
+    }
+
+    static int totalWidth() {
+        int total = 0;
+        forEachField([&](auto i) { total += At<decltype(i)::value>::width; });
+        return total;
+    }
+
+    static void writeHeader(ostream& os) {
+        os << left;
+        forEachField([&](auto i) {
+            using F = At<decltype(i)::value>;
+            os << setw(F::width) << F::label;
+        });
+        os << endl;
+    }
+
+    static void writeRow(ostream& os, const Student& s) {
+        os << left;
+        forEachField([&](auto i) {
+            using F = At<decltype(i)::value>;
+            os << setw(F::width) << F::get(s);
+        });
+        os << endl;
+    }
+
+    // "ID: 1 | Name: ... | Age: ..." for the compact fields only
+    static void writeCompact(ostream& os, const Student& s) {
+        bool first = true;
+        forEachField([&](auto i) {
+            using F = At<decltype(i)::value>;
+            if constexpr (F::compact) {
+                if (!first) os << " | ";
+                os << F::label << ": " << F::get(s);
+                first = false;
+            }
+        });
+        os << endl;
+    }
+
+    // Appends one comma-separated line (without newline) to out
+    static void format(string& out, const Student& s) {
+        forEachField([&](auto i) {
+            using F = At<decltype(i)::value>;
+            if (decltype(i)::value > 0) out += ',';
+            FieldCodec<typename F::Type>::format(out, F::get(s));
+        });
+    }
+
+    // Parses a line written by format(); returns false on a malformed line.
+    // An empty last field ("...,a@x.com,") is read as an empty value.
+    static bool parse(string_view line, Student& s) {
+        string_view tokens[COUNT];
+        size_t count = 0, start = 0;
+        while (true) {
+            if (count == COUNT) return false;
+            size_t comma = line.find(',', start);
+            tokens[count++] = line.substr(start, comma == string_view::npos ? comma : comma - start);
+            if (comma == string_view::npos) break;
+            start = comma + 1;
+        }
+        return count == COUNT && parseFields(tokens, s, make_index_sequence<COUNT>());
+    }
+
+    template <size_t... I>
+    static bool parseFields(const string_view* tokens, Student& s, index_sequence<I...>) {
+        return (FieldCodec<typename At<I>::Type>::parse(tokens[I], At<I>::ref(s)) && ...);
+    }
+
+    // Comparator on field I, e.g. sort(..., StudentSchema::Order<StudentSchema::AGE, false>())
+    template <size_t I, bool Ascending = true>
+    struct Order {
+        bool operator()(const Student& a, const Student& b) const {
+            using F = At<I>;
+            if constexpr (Ascending) {
+                return FieldCodec<typename F::Type>::less(F::get(a), F::get(b));
+            } else {
+                return FieldCodec<typename F::Type>::less(F::get(b), F::get(a));
+            }
+        }
+    };
+};
+
+// Reordering or inserting a Field line without updating the enum would make
+// the sort options silently compare the wrong field
+static_assert(StudentSchema::FIELD_COUNT == StudentSchema::COUNT,
+              "StudentSchema enum must have one entry per Field");
+static_assert(StudentSchema::At<StudentSchema::ID>::label == ID_LABEL, "StudentSchema::ID out of order");
+static_assert(StudentSchema::At<StudentSchema::NAME>::label == NAME_LABEL, "StudentSchema::NAME out of order");
+static_assert(StudentSchema::At<StudentSchema::AGE>::label == AGE_LABEL, "StudentSchema::AGE out of order");
+static_assert(StudentSchema::At<StudentSchema::EMAIL>::label == EMAIL_LABEL, "StudentSchema::EMAIL out of order");
+static_assert(StudentSchema::At<StudentSchema::COURSE>::label == COURSE_LABEL, "StudentSchema::COURSE out of order");
+
+inline void Student::display() const {
+    StudentSchema::writeRow(cout, *this);
+}
+
+inline void Student::displayCompact() const {
+    StudentSchema::writeCompact(cout, *this);
+}
+
+// ================= Lazy Student Store =================
+// Keeps only a sorted ID -> file offset index in memory. Records are read
+// from the data file when asked for and kept in an LRU cache limited to a
+// byte budget. The index is cached next to the data file and rebuilt when
+// the data file's size or modification time changes.
+class LazyStudentStore {
+private:
+    static constexpr uint64_t INDEX_MAGIC = 0x32584449445453ULL;   // "STDIDX2"
+
+    using CacheList = list<pair<int, Student>>;
+
+    string dataPath;
+    string indexPath;
+    vector<int> ids;            // sorted, unique
+    vector<uint64_t> offsets;   // offsets[i] is where the line for ids[i] starts
+    uint64_t corruptedLines = 0;    // lines left out of the index
+    uint64_t repeatedIdLines = 0;
+    ifstream data;
+
+    size_t cacheBudget = 0;
+    size_t cacheBytes = 0;
+    CacheList cache;            // front = most recently used
+    unordered_map<int, CacheList::iterator> cacheLookup;
+
+    // Approximate heap + node cost of one cached record
+    static size_t footprint(const Student& s) {
+        return sizeof(CacheList::value_type) + 4 * sizeof(void*) +
+               s.getName().capacity() + s.getEmail().capacity() + s.getCourse().capacity();
+    }
+
+    static void dataFileStamp(const string& path, uint64_t& size, int64_t& time) {
+        size = filesystem::file_size(path);
+        time = static_cast<int64_t>(filesystem::last_write_time(path).time_since_epoch().count());
+    }
+
+    bool readIndex(uint64_t dataSize, int64_t dataTime) {
+        ifstream file(indexPath, ios::binary);
+        if (!file) return false;
+
+        uint64_t magic = 0, size = 0, count = 0;
+        int64_t time = 0;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        file.read(reinterpret_cast<char*>(&time), sizeof(time));
+        file.read(reinterpret_cast<char*>(&corruptedLines), sizeof(corruptedLines));
+        file.read(reinterpret_cast<char*>(&repeatedIdLines), sizeof(repeatedIdLines));
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!file || magic != INDEX_MAGIC || size != dataSize || time != dataTime) return false;
+
+        // A damaged file can carry any count; only trust it if the body fits exactly
+        streamoff bodyStart = file.tellg();
+        file.seekg(0, ios::end);
+        uint64_t bodySize = static_cast<uint64_t>(file.tellg() - bodyStart);
+        if (count > bodySize / (sizeof(int) + sizeof(uint64_t)) ||
+            count * (sizeof(int) + sizeof(uint64_t)) != bodySize) {
+            return false;
+        }
+        file.seekg(bodyStart);
+
+        ids.resize(count);
+        offsets.resize(count);
+        file.read(reinterpret_cast<char*>(ids.data()), count * sizeof(int));
+        file.read(reinterpret_cast<char*>(offsets.data()), count * sizeof(uint64_t));
+        return static_cast<bool>(file);
+    }
+
+    void writeIndex(uint64_t dataSize, int64_t dataTime) const {
+        ofstream file(indexPath, ios::binary | ios::trunc);
+        if (!file) {
+            cerr << "Warning: Cannot write index file '" << indexPath << "'.\n";
+            return;
+        }
+
+        uint64_t count = ids.size();
+        file.write(reinterpret_cast<const char*>(&INDEX_MAGIC), sizeof(INDEX_MAGIC));
+        file.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+        file.write(reinterpret_cast<const char*>(&dataTime), sizeof(dataTime));
+        file.write(reinterpret_cast<const char*>(&corruptedLines), sizeof(corruptedLines));
+        file.write(reinterpret_cast<const char*>(&repeatedIdLines), sizeof(repeatedIdLines));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        file.write(reinterpret_cast<const char*>(ids.data()), count * sizeof(int));
+        file.write(reinterpret_cast<const char*>(offsets.data()), count * sizeof(uint64_t));
+    }
+
+    // One sequential pass over the data file. Corrupted lines are left out and
+    // the first line wins for a repeated ID; both kinds of skipped line are counted.
+    void buildIndex() {
+        vector<pair<int, uint64_t>> entries;
+        string line;
+        Student scratch;
+        uint64_t offset = 0;
+
+        corruptedLines = 0;
+        repeatedIdLines = 0;
+
+        data.clear();
+        data.seekg(0);
+        while (getline(data, line)) {
+            if (!line.empty()) {
+                if (StudentSchema::parse(line, scratch)) {
+                    entries.emplace_back(scratch.getId(), offset);
+                } else {
+                    corruptedLines++;
+                }
+            }
+            offset += line.size() + 1;
+        }
+
+        stable_sort(entries.begin(), entries.end(),
+                    [](const pair<int, uint64_t>& a, const pair<int, uint64_t>& b) {
+                        return a.first < b.first;
+                    });
+
+        ids.clear();
+        offsets.clear();
+        ids.reserve(entries.size());
+        offsets.reserve(entries.size());
+        for (const auto& e : entries) {
+            if (!ids.empty() && ids.back() == e.first) {
+                repeatedIdLines++;
+                continue;
+            }
+            ids.push_back(e.first);
+            offsets.push_back(e.second);
+        }
+    }
+
+    bool readRecord(uint64_t offset, Student& out) {
+        string line;
+        data.clear();
+        data.seekg(static_cast<streamoff>(offset));
+        return getline(data, line) && StudentSchema::parse(line, out);
+    }
+
+public:
+    // Opens the data file and loads (or builds) its index. Returns false if
+    // the data file does not exist.
+    bool open(const string& dataFile, size_t budgetBytes) {
+        close();
+        dataPath = dataFile;
+        indexPath = dataFile + ".idx";
+        cacheBudget = budgetBytes;
+
+        data.open(dataPath, ios::binary);
+        if (!data) return false;
+
+        uint64_t dataSize;
+        int64_t dataTime;
+        dataFileStamp(dataPath, dataSize, dataTime);
+        if (!readIndex(dataSize, dataTime)) {
+            cout << "Building index for '" << dataPath << "'...\n";
+            buildIndex();
+            writeIndex(dataSize, dataTime);
+        }
+        return true;
+    }
+
+    void close() {
+        if (data.is_open()) data.close();
+        vector<int>().swap(ids);
+        vector<uint64_t>().swap(offsets);
+        cache.clear();
+        cacheLookup.clear();
+        cacheBytes = 0;
+        corruptedLines = 0;
+        repeatedIdLines = 0;
+    }
+
+    size_t size() const { return ids.size(); }
+    int idAt(size_t pos) const { return ids[pos]; }
+    size_t positionOf(int id) const {
+        return static_cast<size_t>(lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+    }
+    int maxId() const { return ids.empty() ? 0 : ids.back(); }
+    uint64_t corruptedLineCount() const { return corruptedLines; }
+    uint64_t repeatedIdLineCount() const { return repeatedIdLines; }
+
+    // Record at position pos in ID order. The pointer stays valid until the
+    // next at()/find() call, which may evict it.
+    const Student* at(size_t pos) {
+        int id = ids[pos];
+
+        auto hit = cacheLookup.find(id);
+        if (hit != cacheLookup.end()) {
+            cache.splice(cache.begin(), cache, hit->second);
+            return &hit->second->second;
+        }
+
+        Student record;
+        if (!readRecord(offsets[pos], record)) return nullptr;
+
+        cacheBytes += footprint(record);
+        cache.emplace_front(id, move(record));
+        cacheLookup[id] = cache.begin();
+
+        while (cacheBytes > cacheBudget && cache.size() > 1) {
+            cacheBytes -= footprint(cache.back().second);
+            cacheLookup.erase(cache.back().first);
+            cache.pop_back();
+        }
+        return &cache.front().second;
+    }
+
+    const Student* find(int id) {
+        auto it = lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id) return nullptr;
+        return at(static_cast<size_t>(it - ids.begin()));
+    }
+
+    // Streams every indexed record in file order without touching the cache,
+    // so a full scan does not evict the records looked up by ID.
+    template <typename F>
+    void scan(F f) {
+        string line;
+        Student record;
+        uint64_t offset = 0;
+
+        data.clear();
+        data.seekg(0);
+        while (getline(data, line)) {
+            uint64_t lineOffset = offset;
+            offset += line.size() + 1;
+            if (line.empty() || !StudentSchema::parse(line, record)) continue;
+
+            // Skip lines the index dropped (repeated IDs)
+            auto it = lower_bound(ids.begin(), ids.end(), record.getId());
+            if (it == ids.end() || offsets[it - ids.begin()] != lineOffset) continue;
+
+            f(record);
+        }
     }
 };
 
@@ -61,6 +486,16 @@ private:
     vector<Student> students;
     int nextId;
 
+    // Lazy mode: records stay on disk and are paged in through lazyStore
+    LazyStudentStore lazyStore;
+    bool lazyMode;
+    static const size_t LAZY_CACHE_BYTES = 16 * 1024 * 1024;
+    static const size_t LAZY_PAGE_SIZE = 20;
+
+    // Sorted identityKey() of every record, for the duplicate check in addStudent
+    vector<uint64_t> identityKeys;
+    bool identityKeysValid;
+
     // Make this private helper function static
     static void clearInputBuffer() {
         cin.clear();
@@ -75,25 +510,440 @@ private:
     
     // Private helper function for sorting by ID
     void sortById() {
-        sort(students.begin(), students.end(),
-             [](const Student& a, const Student& b) {
-                 return a.getId() < b.getId();
-             });
+        sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::ID>());
+    }
+
+    size_t recordCount() const {
+        return lazyMode ? lazyStore.size() : students.size();
+    }
+
+    // Editing, sorting and merging work on the in-memory list, so lazy mode
+    // switches to a full load the first time one of them is used.
+    void ensureLoaded() {
+        if (!lazyMode) return;
+        cout << "\nLoading full roster for editing...\n";
+        lazyStore.close();
+        lazyMode = false;
+        loadFromFile();
+    }
+
+    // Visits every record; streams from disk in lazy mode
+    template <typename F>
+    void forEachStudent(F f) {
+        if (lazyMode) {
+            lazyStore.scan(f);
+        } else {
+            for (const auto& s : students) f(s);
+        }
+    }
+
+    const Student* findById(int id) {
+        if (lazyMode) return lazyStore.find(id);
+        for (const auto& s : students) {
+            if (s.getId() == id) return &s;
+        }
+        return nullptr;
+    }
+
+    int idAt(size_t pos) const {
+        return lazyMode ? lazyStore.idAt(pos) : students[pos].getId();
+    }
+
+    // Like forEachStudent, but also passes the record's index (see findDuplicates)
+    template <typename F>
+    void forEachIndexed(F f) {
+        if (lazyMode) {
+            lazyStore.scan([&](const Student& s) { f(lazyStore.positionOf(s.getId()), s); });
+        } else {
+            for (size_t i = 0; i < students.size(); i++) f(i, students[i]);
+        }
+    }
+
+    void displayCompactAt(size_t index) {
+        const Student* s = lazyMode ? lazyStore.at(index) : &students[index];
+        if (s) s->displayCompact();
+    }
+
+    // Lazy mode shows the roster a page at a time, in ID order
+    void displayPages() {
+        clearInputBuffer();
+        for (size_t pos = 0; pos < lazyStore.size(); pos++) {
+            if (pos > 0 && pos % LAZY_PAGE_SIZE == 0) {
+                cout << "-- " << pos << "/" << lazyStore.size()
+                     << " shown. Press Enter for more, 'q' to stop: ";
+                string reply;
+                getline(cin, reply);
+                if (toLower(reply) == "q") break;
+            }
+            const Student* s = lazyStore.at(pos);
+            if (s) s->display();
+        }
+    }
+
+    // ================= DUPLICATE DETECTION HELPERS =================
+    // Records are only compared when they share a blocking key (normalized
+    // email or normalized name), so the pass is a sort instead of O(n^2).
+    // Two different non-empty emails always mean two different people; a
+    // common name on its own is never enough.
+    static constexpr int NEAR_DUPLICATE_THRESHOLD = 90;   // similarity 0-100
+    static constexpr size_t BLOCK_WINDOW = 32;            // max neighbours compared per record
+
+    struct DuplicatePair {
+        size_t keep;    // index of the record kept on merge (lowest ID)
+        size_t dup;     // index of the duplicate record
+        int score;      // 100 = exact duplicate
+    };
+
+    static string normalizeEmail(const string& email) {
+        size_t first = email.find_first_not_of(" \t\r");
+        if (first == string::npos) return "";
+        size_t last = email.find_last_not_of(" \t\r");
+
+        string out;
+        out.reserve(last - first + 1);
+        for (size_t i = first; i <= last; i++) {
+            out += static_cast<char>(asciiLower(static_cast<unsigned char>(email[i])));
+        }
+        return out;
+    }
+
+    // Bytes >= 0x80 belong to UTF-8 characters (علی, René); they are kept as-is,
+    // since the C locale's isalnum/tolower know nothing about them.
+    static bool isNameByte(unsigned char c) {
+        return c >= 0x80 || isalnum(c);
+    }
+
+    static unsigned char asciiLower(unsigned char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+    }
+
+    // Lowercase ASCII, drop punctuation and collapse whitespace:
+    // "  John  O'Neil" -> "john oneil", "René" -> "rené"
+    static string normalizeName(const string& name) {
+        string out;
+        out.reserve(name.size());
+        for (unsigned char c : name) {
+            if (isNameByte(c)) {
+                out += static_cast<char>(asciiLower(c));
+            } else if (isspace(c) && !out.empty() && out.back() != ' ') {
+                out += ' ';
+            }
+        }
+        if (!out.empty() && out.back() == ' ') out.pop_back();
+        return out;
+    }
+
+    // FNV-1a over the same characters normalizeEmail/normalizeName keep, so
+    // blocking keys are built without a temporary string per record.
+    // Returns false when the normalized value would be empty.
+    static bool hashNormalizedEmail(const string& email, size_t& key) {
+        size_t first = email.find_first_not_of(" \t\r");
+        if (first == string::npos) return false;
+        size_t last = email.find_last_not_of(" \t\r");
+
+        uint64_t h = 14695981039346656037ULL;
+        for (size_t i = first; i <= last; i++) {
+            h = (h ^ asciiLower(static_cast<unsigned char>(email[i]))) * 1099511628211ULL;
+        }
+        key = static_cast<size_t>(h);
+        return true;
+    }
+
+    static bool hashNormalizedName(const string& name, size_t& key) {
+        uint64_t h = 14695981039346656037ULL;
+        bool any = false, pendingSpace = false;
+        for (unsigned char c : name) {
+            if (isNameByte(c)) {
+                if (pendingSpace) h = (h ^ ' ') * 1099511628211ULL;
+                h = (h ^ asciiLower(c)) * 1099511628211ULL;
+                any = true;
+                pendingSpace = false;
+            } else if (isspace(c) && any) {
+                pendingSpace = true;
+            }
+        }
+        key = static_cast<size_t>(h);
+        return any;
+    }
+
+    // Levenshtein distance scaled to 0-100 (100 = identical). An empty value
+    // is no evidence, so it never matches anything, not even another empty one.
+    static int similarity(const string& a, const string& b) {
+        if (a.empty() || b.empty()) return 0;
+        if (a == b) return 100;
+
+        vector<size_t> prev(b.size() + 1), curr(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); j++) prev[j] = j;
+
+        for (size_t i = 1; i <= a.size(); i++) {
+            curr[0] = i;
+            for (size_t j = 1; j <= b.size(); j++) {
+                size_t cost = (a[i-1] == b[j-1]) ? 0 : 1;
+                curr[j] = min({prev[j] + 1, curr[j-1] + 1, prev[j-1] + cost});
+            }
+            swap(prev, curr);
+        }
+
+        size_t longest = max(a.size(), b.size());
+        return static_cast<int>(100 - (prev[b.size()] * 100) / longest);
+    }
+
+    // Same email: the name similarity decides. Missing email on either side:
+    // a matching name is at most a near duplicate. Different emails: 0.
+    int recordSimilarity(const Student& a, const Student& b) const {
+        string emailA = normalizeEmail(a.getEmail());
+        string emailB = normalizeEmail(b.getEmail());
+        if (!emailA.empty() && !emailB.empty() && emailA != emailB) return 0;
+
+        int nameScore = similarity(normalizeName(a.getName()), normalizeName(b.getName()));
+        if (emailA.empty() || emailB.empty()) {
+            return min(nameScore, NEAR_DUPLICATE_THRESHOLD);
+        }
+        return nameScore;
+    }
+
+    static bool hasEmail(const Student& s) {
+        return s.getEmail().find_first_not_of(" \t\r") != string::npos;
+    }
+
+    // Sorts (key hash, record index) pairs so each block is a contiguous run,
+    // then scores records against their neighbours inside the run. get(index)
+    // returns the record, by reference or (from the lazy store) by value.
+    template <typename Get>
+    void scanBlocks(vector<pair<size_t, size_t>>& keys, bool skipEmailPairs,
+                    Get get, vector<DuplicatePair>& pairs) const {
+        sort(keys.begin(), keys.end());
+
+        size_t blockStart = 0;
+        while (blockStart < keys.size()) {
+            size_t blockEnd = blockStart + 1;
+            while (blockEnd < keys.size() && keys[blockEnd].first == keys[blockStart].first) {
+                blockEnd++;
+            }
+
+            for (size_t i = blockStart; i < blockEnd; i++) {
+                size_t windowEnd = min(blockEnd, i + 1 + BLOCK_WINDOW);
+                for (size_t j = i + 1; j < windowEnd; j++) {
+                    const Student& a = get(keys[i].second);
+                    const Student& b = get(keys[j].second);
+
+                    // If both have an email, the email pass already scored the pair
+                    // (same email) or it cannot match (different emails); only
+                    // records without an email need this pass. No string work here,
+                    // so large blocks of a common name stay cheap.
+                    if (skipEmailPairs && hasEmail(a) && hasEmail(b)) continue;
+
+                    int score = recordSimilarity(a, b);
+                    if (score >= NEAR_DUPLICATE_THRESHOLD) {
+                        size_t keep = keys[i].second, dup = keys[j].second;
+                        if (b.getId() < a.getId()) swap(keep, dup);
+                        pairs.push_back({keep, dup, score});
+                    }
+                }
+            }
+            blockStart = blockEnd;
+        }
+    }
+
+    template <typename Get>
+    vector<DuplicatePair> findDuplicates(Get get) {
+        vector<DuplicatePair> pairs;
+        vector<pair<size_t, size_t>> keys;
+        keys.reserve(recordCount());
+        size_t key;
+
+        // Pass 1: block on normalized email
+        forEachIndexed([&](size_t i, const Student& s) {
+            if (hashNormalizedEmail(s.getEmail(), key)) keys.emplace_back(key, i);
+        });
+        scanBlocks(keys, false, get, pairs);
+
+        // Pass 2: block on normalized name (records with no email)
+        keys.clear();
+        forEachIndexed([&](size_t i, const Student& s) {
+            if (hashNormalizedName(s.getName(), key)) keys.emplace_back(key, i);
+        });
+        scanBlocks(keys, true, get, pairs);
+
+        return pairs;
+    }
+
+    // Pair indices refer to students[] or, in lazy mode, to positions in the
+    // store's ID order. Lazy mode only pages in the records it scores.
+    vector<DuplicatePair> findDuplicates() {
+        if (lazyMode) {
+            return findDuplicates([this](size_t pos) {
+                const Student* s = lazyStore.at(pos);
+                return s ? *s : Student();
+            });
+        }
+        return findDuplicates([this](size_t i) -> const Student& { return students[i]; });
+    }
+
+    static bool isMissingCourse(const string& course) {
+        return course.empty() || course == "Not Specified";
+    }
+
+    // Union-find over the exact pairs only. roots[i] is the index of the record
+    // that survives for students[i]: the lowest ID of its group, or i itself.
+    // Near duplicates are never merged: two people may share an email address.
+    vector<size_t> exactMergeRoots(const vector<DuplicatePair>& pairs) const {
+        vector<size_t> parent(students.size());
+        for (size_t i = 0; i < parent.size(); i++) parent[i] = i;
+
+        auto findRoot = [&parent](size_t x) {
+            while (parent[x] != x) {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+
+        for (const auto& p : pairs) {
+            if (p.score < 100) continue;
+            size_t a = findRoot(p.keep), b = findRoot(p.dup);
+            if (a == b) continue;
+            if (students[b].getId() < students[a].getId()) swap(a, b);
+            parent[b] = a;
+        }
+
+        for (size_t i = 0; i < parent.size(); i++) parent[i] = findRoot(i);
+        return parent;
+    }
+
+    // Shows what a merge would drop: each removed ID and any field whose value
+    // differs from the record that is kept
+    void previewMerge(const vector<size_t>& roots) const {
+        const size_t maxShown = 20;
+        size_t shown = 0, total = 0;
+        unordered_map<size_t, string> filledCourse;   // backfills, in merge order
+
+        for (size_t i = 0; i < roots.size(); i++) {
+            if (roots[i] == i) continue;
+            total++;
+            if (shown == maxShown) continue;
+            shown++;
+
+            const Student& kept = students[roots[i]];
+            const Student& dropped = students[i];
+            auto filled = filledCourse.find(roots[i]);
+            const string& keptCourse = (filled != filledCourse.end()) ? filled->second : kept.getCourse();
+
+            cout << "Remove ID " << dropped.getId() << " (keep ID " << kept.getId() << ")";
+            if (dropped.getName() != kept.getName()) {
+                cout << " | Name '" << dropped.getName() << "' lost, keeping '" << kept.getName() << "'";
+            }
+            if (dropped.getEmail() != kept.getEmail()) {
+                cout << " | Email '" << dropped.getEmail() << "' lost, keeping '" << kept.getEmail() << "'";
+            }
+            if (dropped.getAge() != kept.getAge()) {
+                cout << " | Age " << dropped.getAge() << " lost, keeping " << kept.getAge();
+            }
+            if (!isMissingCourse(dropped.getCourse()) && dropped.getCourse() != keptCourse) {
+                if (isMissingCourse(keptCourse)) {
+                    cout << " | Course '" << dropped.getCourse() << "' copied to ID " << kept.getId();
+                    filledCourse[roots[i]] = dropped.getCourse();
+                } else {
+                    cout << " | Course '" << dropped.getCourse() << "' lost, keeping '"
+                         << keptCourse << "'";
+                }
+            }
+            cout << "\n";
+        }
+        if (total > shown) {
+            cout << "... and " << (total - shown) << " more record(s).\n";
+        }
+    }
+
+    // Drops every record whose root is another record. A missing course on the
+    // kept record is filled from the first dropped record that has one.
+    size_t mergeDuplicates(const vector<size_t>& roots) {
+        for (size_t i = 0; i < students.size(); i++) {
+            size_t root = roots[i];
+            if (root == i) continue;
+            if (isMissingCourse(students[root].getCourse()) &&
+                !isMissingCourse(students[i].getCourse())) {
+                students[root].setCourse(students[i].getCourse());
+            }
+        }
+
+        vector<Student> merged;
+        merged.reserve(students.size());
+        for (size_t i = 0; i < students.size(); i++) {
+            if (roots[i] == i) merged.push_back(students[i]);
+        }
+
+        size_t removed = students.size() - merged.size();
+        students.swap(merged);
+        identityKeysValid = false;
+        return removed;
+    }
+
+    // Hash of the normalized (name, email) pair; equal for exact duplicates.
+    // Like recordSimilarity(), a record with an empty normalized name or email
+    // can never be an exact duplicate, so it gets no key.
+    static bool identityKey(const string& name, const string& email, uint64_t& key) {
+        size_t nameKey, emailKey;
+        if (!hashNormalizedName(name, nameKey) || !hashNormalizedEmail(email, emailKey)) return false;
+        key = static_cast<uint64_t>(nameKey) * 0x9E3779B97F4A7C15ULL ^ emailKey;
+        return true;
+    }
+
+    // Built at load, then kept in step by add/update/delete
+    void buildIdentityKeys() {
+        identityKeys.clear();
+        identityKeys.reserve(students.size());
+        uint64_t key;
+        for (const auto& s : students) {
+            if (identityKey(s.getName(), s.getEmail(), key)) identityKeys.push_back(key);
+        }
+        sort(identityKeys.begin(), identityKeys.end());
+        identityKeysValid = true;
+    }
+
+    void addIdentityKey(const Student& s) {
+        uint64_t key;
+        if (!identityKeysValid || !identityKey(s.getName(), s.getEmail(), key)) return;
+        identityKeys.insert(upper_bound(identityKeys.begin(), identityKeys.end(), key), key);
+    }
+
+    void removeIdentityKey(const Student& s) {
+        uint64_t key;
+        if (!identityKeysValid || !identityKey(s.getName(), s.getEmail(), key)) return;
+        auto it = lower_bound(identityKeys.begin(), identityKeys.end(), key);
+        if (it != identityKeys.end() && *it == key) identityKeys.erase(it);
+    }
+
+    // A 64-bit hash match is taken as a duplicate; this only triggers a prompt
+    bool hasExactDuplicate(const string& name, const string& email) {
+        uint64_t key;
+        if (!identityKey(name, email, key)) return false;
+        if (!identityKeysValid) buildIdentityKeys();
+        return binary_search(identityKeys.begin(), identityKeys.end(), key);
     }
 
 public:
-    StudentManagementSystem() : nextId(1) {}
+    StudentManagementSystem() : nextId(1), lazyMode(false), identityKeysValid(false) {}
 
     // ================= FILE HANDLING =================
     void saveToFile() const {
+        if (lazyMode) {
+            cout << "\nNo changes to save (lazy mode is read-only).\n";
+            return;
+        }
+
         ofstream file("students.txt");
         if (!file) {
             cerr << "Error: Cannot save to file!\n";
             return;
         }
         
+        string line;
         for (const auto& s : students) {
-            file << s.toFileString() << "\n";
+            line.clear();
+            StudentSchema::format(line, s);
+            line += '\n';
+            file << line;
         }
         file.close();
         cout << "\n✅ Data saved successfully to 'students.txt'!\n";
@@ -106,39 +956,73 @@ public:
             return;
         }
 
+        unordered_set<int> seenIds;
+        vector<size_t> repeatedIds;   // records whose ID was already used
+
         string line;
+        Student student;
         while (getline(file, line)) {
             if (line.empty()) continue;
-            
-            stringstream ss(line);
-            string token;
-            vector<string> tokens;
-            
-            while (getline(ss, token, ',')) {
-                tokens.push_back(token);
+
+            if (!StudentSchema::parse(line, student)) {
+                cerr << "Warning: Corrupted data line skipped: " << line << endl;
+                continue;
             }
-            
-            if (tokens.size() == 5) {
-                try {
-                    int id = stoi(tokens[0]);
-                    string name = tokens[1];
-                    int age = stoi(tokens[2]);
-                    string email = tokens[3];
-                    string course = tokens[4];
-                    
-                    students.emplace_back(id, name, age, email, course);
-                    nextId = max(nextId, id + 1);
-                } catch (...) {
-                    cerr << "Warning: Corrupted data line skipped: " << line << endl;
-                }
+
+            // Binary search relies on unique IDs; repeats are renumbered below
+            if (!seenIds.insert(student.getId()).second) {
+                repeatedIds.push_back(students.size());
             }
+
+            nextId = max(nextId, student.getId() + 1);
+            students.push_back(move(student));
         }
         file.close();
+
+        // Only now is nextId past every ID in the file, so new IDs cannot clash
+        for (size_t i : repeatedIds) {
+            cout << "⚠️  ID " << students[i].getId() << " is used more than once; "
+                 << students[i].getName() << " was given ID " << nextId << ".\n";
+            students[i].setId(nextId++);
+        }
+
         cout << "✅ Loaded " << students.size() << " student records.\n";
+
+        // Only the cheap exact check runs at load; fuzzy scoring is on demand
+        buildIdentityKeys();
+        size_t exactDuplicates = 0;
+        for (size_t i = 1; i < identityKeys.size(); i++) {
+            if (identityKeys[i] == identityKeys[i-1]) exactDuplicates++;
+        }
+        if (exactDuplicates > 0) {
+            cout << "⚠️  " << exactDuplicates << " exact duplicate record(s) found. "
+                 << "Use 'Find Duplicates' from the main menu to review.\n";
+        }
+    }
+
+    // Startup alternative to loadFromFile(): only the ID index is loaded
+    void openLazy() {
+        if (!lazyStore.open("students.txt", LAZY_CACHE_BYTES)) {
+            cout << "No existing data found. Starting fresh.\n";
+            return;
+        }
+        lazyMode = true;
+        nextId = lazyStore.maxId() + 1;
+        cout << "✅ Indexed " << lazyStore.size() << " student records (lazy mode).\n";
+
+        if (lazyStore.corruptedLineCount() > 0) {
+            cerr << "Warning: " << lazyStore.corruptedLineCount() << " corrupted data line(s) skipped.\n";
+        }
+        if (lazyStore.repeatedIdLineCount() > 0) {
+            cout << "⚠️  " << lazyStore.repeatedIdLineCount() << " line(s) reuse an ID and are hidden; "
+                 << "run without --lazy to renumber them.\n";
+        }
     }
 
     // ================= ADD STUDENT =================
     void addStudent() {
+        ensureLoaded();
+
         string name, email, course;
         int age;
 
@@ -171,6 +1055,17 @@ public:
             cout << "⚠️  Warning: Email format might be invalid.\n";
         }
 
+        if (hasExactDuplicate(name, email)) {
+            cout << "⚠️  A student with the same name and email already exists.\n";
+            cout << "Add anyway? (yes/no): ";
+            string confirm;
+            getline(cin, confirm);
+            if (toLower(confirm) != "yes" && toLower(confirm) != "y") {
+                cout << "\n❌ Student not added.\n";
+                return;
+            }
+        }
+
         cout << "Enter course: ";
         getline(cin, course);
         
@@ -179,35 +1074,37 @@ public:
         }
 
         students.emplace_back(nextId++, name, age, email, course);
+        addIdentityKey(students.back());
         cout << "\n✅ Student added successfully! (ID: " << (nextId-1) << ")\n";
     }
 
     // ================= DISPLAY STUDENTS =================
-    void displayAllStudents() const {
-        if (students.empty()) {
+    void displayAllStudents() {
+        if (recordCount() == 0) {
             cout << "\n📭 No student records found.\n";
             return;
         }
 
-        cout << "\n" << string(70, '=') << "\n";
-        cout << "               STUDENT LIST (" << students.size() << " records)\n";
-        cout << string(70, '=') << "\n";
-        cout << left << setw(5) << "ID"
-             << setw(20) << "Name"
-             << setw(5) << "Age"
-             << setw(25) << "Email"
-             << setw(15) << "Course" << endl;
-        cout << string(70, '-') << endl;
+        const int tableWidth = StudentSchema::totalWidth();
+        cout << "\n" << string(tableWidth, '=') << "\n";
+        cout << "               STUDENT LIST (" << recordCount() << " records)\n";
+        cout << string(tableWidth, '=') << "\n";
+        StudentSchema::writeHeader(cout);
+        cout << string(tableWidth, '-') << endl;
         
-        for (const auto& s : students)
-            s.display();
+        if (lazyMode) {
+            displayPages();
+        } else {
+            for (const auto& s : students)
+                s.display();
+        }
             
-        cout << string(70, '=') << "\n";
+        cout << string(tableWidth, '=') << "\n";
     }
 
     // ================= LINEAR SEARCH =================
     void linearSearchStudent() {
-        if (students.empty()) {
+        if (recordCount() == 0) {
             cout << "\n📭 No data available for search.\n";
             return;
         }
@@ -232,18 +1129,13 @@ public:
                 cout << "Enter student ID: ";
                 cin >> id;
                 
-                bool found = false;
-                for (const auto& s : students) {
-                    if (s.getId() == id) {
-                        cout << "\n✅ Student Found:\n";
-                        cout << string(60, '-') << "\n";
-                        s.display();
-                        cout << string(60, '-') << "\n";
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
+                const Student* s = findById(id);
+                if (s) {
+                    cout << "\n✅ Student Found:\n";
+                    cout << string(60, '-') << "\n";
+                    s->display();
+                    cout << string(60, '-') << "\n";
+                } else {
                     cout << "❌ Student with ID " << id << " not found.\n";
                 }
                 break;
@@ -256,11 +1148,11 @@ public:
                 string searchName = toLower(name);
                 vector<Student> results;
                 
-                for (const auto& s : students) {
+                forEachStudent([&](const Student& s) {
                     if (toLower(s.getName()).find(searchName) != string::npos) {
                         results.push_back(s);
                     }
-                }
+                });
                 
                 if (!results.empty()) {
                     cout << "\n🔍 Found " << results.size() << " matching student(s):\n";
@@ -282,11 +1174,11 @@ public:
                 string searchCourse = toLower(course);
                 vector<Student> results;
                 
-                for (const auto& s : students) {
+                forEachStudent([&](const Student& s) {
                     if (toLower(s.getCourse()).find(searchCourse) != string::npos) {
                         results.push_back(s);
                     }
-                }
+                });
                 
                 if (!results.empty()) {
                     cout << "\n👨‍🎓 Found " << results.size() << " student(s) in course '" << course << "':\n";
@@ -309,14 +1201,14 @@ public:
 
     // ================= BINARY SEARCH =================
     void binarySearchStudent() {
-        if (students.empty()) {
+        if (recordCount() == 0) {
             cout << "\n📭 No data available for search.\n";
             return;
         }
 
-        // Check if already sorted by ID
+        // Check if already sorted by ID (the lazy index always is)
         bool isSorted = true;
-        for (size_t i = 1; i < students.size(); i++) {
+        for (size_t i = 1; !lazyMode && i < students.size(); i++) {
             if (students[i].getId() < students[i-1].getId()) {
                 isSorted = false;
                 break;
@@ -349,21 +1241,22 @@ public:
         cout << "\nEnter student ID to search: ";
         cin >> id;
 
-        int low = 0, high = students.size() - 1;
+        int low = 0, high = static_cast<int>(recordCount()) - 1;
         int comparisons = 0;
         
         while (low <= high) {
             int mid = low + (high - low) / 2;
             comparisons++;
             
-            if (students[mid].getId() == id) {
+            if (idAt(mid) == id) {
                 cout << "\n✅ Student Found (Binary Search - " << comparisons << " comparisons):\n";
                 cout << string(60, '=') << "\n";
-                students[mid].display();
+                const Student* found = lazyMode ? lazyStore.at(mid) : &students[mid];
+                if (found) found->display();
                 cout << string(60, '=') << "\n";
                 return;
             }
-            else if (students[mid].getId() < id) {
+            else if (idAt(mid) < id) {
                 low = mid + 1;
             } else {
                 high = mid - 1;
@@ -375,6 +1268,7 @@ public:
 
     // ================= SORTING MENU =================
     void sortMenu() {
+        ensureLoaded();
         if (students.empty()) {
             cout << "\n📭 No students to sort.\n";
             return;
@@ -399,45 +1293,27 @@ public:
         cout << "\n";
         switch(choice) {
             case 1:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return a.getId() < b.getId();
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::ID, true>());
                 cout << "✅ Students sorted by ID (Ascending)!\n";
                 break;
             case 2:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return a.getId() > b.getId();
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::ID, false>());
                 cout << "✅ Students sorted by ID (Descending)!\n";
                 break;
             case 3:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return toLower(a.getName()) < toLower(b.getName());
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::NAME, true>());
                 cout << "✅ Students sorted by Name (A-Z)!\n";
                 break;
             case 4:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return toLower(a.getName()) > toLower(b.getName());
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::NAME, false>());
                 cout << "✅ Students sorted by Name (Z-A)!\n";
                 break;
             case 5:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return a.getAge() < b.getAge();
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::AGE, true>());
                 cout << "✅ Students sorted by Age (Youngest first)!\n";
                 break;
             case 6:
-                sort(students.begin(), students.end(),
-                     [](const Student& a, const Student& b) {
-                         return a.getAge() > b.getAge();
-                     });
+                sort(students.begin(), students.end(), StudentSchema::Order<StudentSchema::AGE, false>());
                 cout << "✅ Students sorted by Age (Oldest first)!\n";
                 break;
             case 7:
@@ -474,6 +1350,7 @@ public:
 
     // ================= UPDATE STUDENT =================
     void updateStudent() {
+        ensureLoaded();
         if (students.empty()) {
             cout << "\n📭 No students to update.\n";
             return;
@@ -493,6 +1370,8 @@ public:
                 string name, email, course;
                 int age;
 
+                removeIdentityKey(s);
+
                 clearInputBuffer();
                 cout << "New name (press Enter to keep '" << s.getName() << "'): ";
                 getline(cin, name);
@@ -511,6 +1390,7 @@ public:
                 cout << "New course (press Enter to keep '" << s.getCourse() << "'): ";
                 getline(cin, course);
                 if (!course.empty()) s.setCourse(course);
+                addIdentityKey(s);
 
                 cout << "\n✅ Student record updated successfully!\n";
                 
@@ -526,6 +1406,7 @@ public:
 
     // ================= DELETE STUDENT =================
     void deleteStudent() {
+        ensureLoaded();
         if (students.empty()) {
             cout << "\n📭 No students to delete.\n";
             return;
@@ -548,6 +1429,7 @@ public:
                 getline(cin, confirm);
                 
                 if (toLower(confirm) == "yes" || toLower(confirm) == "y") {
+                    removeIdentityKey(*it);
                     students.erase(it);
                     cout << "\n✅ Student record deleted successfully!\n";
                 } else {
@@ -560,8 +1442,8 @@ public:
     }
 
     // ================= STATISTICS =================
-    void showStatistics() const {
-        if (students.empty()) {
+    void showStatistics() {
+        if (recordCount() == 0) {
             cout << "\n📭 No statistics available (empty database).\n";
             return;
         }
@@ -569,46 +1451,113 @@ public:
         cout << "\n" << string(50, '=') << "\n";
         cout << "          DATABASE STATISTICS\n";
         cout << string(50, '=') << "\n";
-        cout << "Total Students: " << students.size() << "\n";
+        cout << "Total Students: " << recordCount() << "\n";
+        
+        // One pass collects both the age statistics and the course counts
+        long long totalAge = 0;
+        int minAge = numeric_limits<int>::max();
+        int maxAge = numeric_limits<int>::min();
+        map<string, int> courseCounts;
+
+        forEachStudent([&](const Student& s) {
+            totalAge += s.getAge();
+            if (s.getAge() < minAge) minAge = s.getAge();
+            if (s.getAge() > maxAge) maxAge = s.getAge();
+            courseCounts[s.getCourse()]++;
+        });
         
         // Age statistics
-        if (!students.empty()) {
-            int totalAge = 0;
-            int minAge = students[0].getAge();
-            int maxAge = students[0].getAge();
-            
-            for (const auto& s : students) {
-                totalAge += s.getAge();
-                if (s.getAge() < minAge) minAge = s.getAge();
-                if (s.getAge() > maxAge) maxAge = s.getAge();
-            }
-            
-            double avgAge = static_cast<double>(totalAge) / students.size();
-            cout << "Average Age: " << fixed << setprecision(1) << avgAge << " years\n";
-            cout << "Age Range: " << minAge << " - " << maxAge << " years\n";
-        }
+        double avgAge = static_cast<double>(totalAge) / recordCount();
+        cout << "Average Age: " << fixed << setprecision(1) << avgAge << " years\n";
+        cout << "Age Range: " << minAge << " - " << maxAge << " years\n";
         
         // Course distribution
         cout << "\nCourse Distribution:\n";
         cout << string(30, '-') << "\n";
         
-        vector<string> courses;
-        for (const auto& s : students) {
-            courses.push_back(s.getCourse());
+        for (const auto& entry : courseCounts) {
+            cout << left << setw(20) << entry.first << ": " << entry.second << " student(s)\n";
         }
         
-        sort(courses.begin(), courses.end());
-        courses.erase(unique(courses.begin(), courses.end()), courses.end());
-        
-        for (const auto& course : courses) {
-            int count = 0;
-            for (const auto& s : students) {
-                if (s.getCourse() == course) count++;
+        cout << string(50, '=') << "\n";
+    }
+
+    // ================= DUPLICATE DETECTION =================
+    void duplicateMenu() {
+        if (recordCount() == 0) {
+            cout << "\n📭 No students to check.\n";
+            return;
+        }
+
+        cout << "\n" << string(40, '=') << "\n";
+        cout << "         DUPLICATE DETECTION\n";
+        cout << string(40, '=') << "\n";
+        cout << "1. Report duplicates\n";
+        cout << "2. Merge exact duplicates (keep lowest ID)\n";
+        cout << "3. Back to Main Menu\n";
+        cout << string(40, '-') << "\n";
+        cout << "Choose: ";
+
+        int choice;
+        cin >> choice;
+        if (choice != 1 && choice != 2) {
+            if (choice != 3) cout << "❌ Invalid choice!\n";
+            return;
+        }
+
+        // Reporting reads through the lazy store; merging edits the list
+        if (choice == 2) ensureLoaded();
+
+        vector<DuplicatePair> pairs = findDuplicates();
+        if (pairs.empty()) {
+            cout << "\n✅ No duplicate records found.\n";
+            return;
+        }
+
+        size_t exact = 0;
+        for (const auto& p : pairs) {
+            if (p.score == 100) exact++;
+        }
+
+        cout << "\n🔍 Found " << pairs.size() << " duplicate pair(s): "
+             << exact << " exact, " << (pairs.size() - exact) << " near.\n";
+
+        if (choice == 1) {
+            const size_t maxShown = 20;
+            for (size_t i = 0; i < pairs.size() && i < maxShown; i++) {
+                cout << string(60, '-') << "\n";
+                cout << "Similarity: " << pairs[i].score << "%\n";
+                displayCompactAt(pairs[i].keep);
+                displayCompactAt(pairs[i].dup);
+            }
+            cout << string(60, '-') << "\n";
+            if (pairs.size() > maxShown) {
+                cout << "... and " << (pairs.size() - maxShown) << " more pair(s).\n";
             }
-            cout << left << setw(20) << course << ": " << count << " student(s)\n";
+            return;
+        }
+
+        if (exact == 0) {
+            cout << "No exact duplicates to merge. Review near duplicates with the report.\n";
+            return;
+        }
+
+        vector<size_t> roots = exactMergeRoots(pairs);
+        cout << "Only exact duplicates are merged; near duplicates are kept.\n";
+        cout << string(60, '-') << "\n";
+        previewMerge(roots);
+        cout << string(60, '-') << "\n";
+        cout << "Enter 'yes' to merge them: ";
+        string confirm;
+        clearInputBuffer();
+        getline(cin, confirm);
+
+        if (toLower(confirm) == "yes" || toLower(confirm) == "y") {
+            size_t removed = mergeDuplicates(roots);
+            cout << "\n✅ Merged duplicates, " << removed << " record(s) removed.\n";
+        } else {
+            cout << "\n❌ Merge cancelled.\n";
         }
-        
-        cout << string(50, '=') << "\n";
     }
 
     // ================= MAIN MENU =================
@@ -616,7 +1565,7 @@ public:
         cout << "\n" << string(50, '=') << "\n";
         cout << "    STUDENT RECORD MANAGEMENT SYSTEM \n";
         cout << string(50, '=') << "\n";
-        cout << "Total Students: " << students.size() << "\n";
+        cout << "Total Students: " << recordCount() << "\n";
         cout << string(50, '-') << "\n";
         cout << "1. Add New Student\n";
         cout << "2. View All Students\n";
@@ -625,9 +1574,10 @@ public:
         cout << "5. Update Student Record\n";
         cout << "6. Delete Student\n";
         cout << "7. Show Statistics\n";
-        cout << "8. Save & Exit\n";
+        cout << "8. Find Duplicates\n";
+        cout << "9. Save & Exit\n";
         cout << string(50, '-') << "\n";
-        cout << "Choose option (1-8): ";
+        cout << "Choose option (1-9): ";
     }
 };
 bool authenticate() {
@@ -660,7 +1610,12 @@ bool authenticate() {
     return false;
 }
 // =========================== MAIN ===========================
-int main() {
+// Run with --lazy to page records in on demand instead of loading them all
+int main(int argc, char* argv[]) {
+    bool lazy = false;
+    for (int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--lazy") lazy = true;
+    }
 
     if (!authenticate()) {
         return 0;   // Exit program if login fails
@@ -670,7 +1625,11 @@ int main() {
     cout << "  WELCOME TO STUDENT RECORD MANAGEMENT SYSTEM\n";
     cout << string(60, '*') << "\n";
     
-    system.loadFromFile();
+    if (lazy) {
+        system.openLazy();
+    } else {
+        system.loadFromFile();
+    }
     
     int choice;
     do {
@@ -680,7 +1639,7 @@ int main() {
             cin.clear();
             // Use a simple clear buffer here since we can't access the private method
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "\n❌ Invalid input! Please enter a number 1-8.\n";
+            cout << "\n❌ Invalid input! Please enter a number 1-9.\n";
             continue;
         }
         
@@ -692,7 +1651,8 @@ int main() {
             case 5: system.updateStudent(); break;
             case 6: system.deleteStudent(); break;
             case 7: system.showStatistics(); break;
-            case 8:
+            case 8: system.duplicateMenu(); break;
+            case 9:
                 system.saveToFile();
                 cout << "\n" << string(50, '=') << "\n";
                 cout << "         THANK YOU FOR USING\n";
@@ -700,14 +1660,14 @@ int main() {
                 cout << string(50, '=') << "\n";
                 break;
             default:
-                cout << "\n❌ Invalid option! Please choose 1-8.\n";
+                cout << "\n❌ Invalid option! Please choose 1-9.\n";
         }
         
         cout << "\nPress Enter to continue...";
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
         cin.get();
         
-    } while (choice != 8);
+    } while (choice != 9);
 
     return 0;
 }